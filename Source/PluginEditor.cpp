@@ -14,6 +14,11 @@ const char* getMimeType(const juce::String& path) {
     return "application/octet-stream";
 }
 
+// Event payload names, in the order of AnalysisFrame::scalars
+constexpr const char* scalarFieldNames[] = {
+    "dryRms",  "wetRms",  "dryWidth",    "wetWidth",    "inputL",      "inputR",
+    "outputL", "outputR", "spectralLow", "spectralMid", "spectralHigh"};
+
 std::optional<juce::WebBrowserComponent::Resource> getResource(const juce::String& url) {
     // Extract path from URL
     juce::String path = url;
@@ -64,7 +69,22 @@ SoundFieldAudioProcessorEditor::SoundFieldAudioProcessorEditor(
                   .withOptionsFrom(outputGainRelay)
                   .withOptionsFrom(inputGainRelay)
                   .withOptionsFrom(colorThemeRelay)
-                  .withOptionsFrom(bypassRelay)) {
+                  .withOptionsFrom(bypassRelay)
+                  .withEventListener("audioAnalysisResync",
+                                     [this](const juce::var&) {
+                                       // Page (re)loaded: next emit sends
+                                       // every field
+                                       needsFullFrame = true;
+                                     })
+                  .withEventListener("audioAnalysisFocus",
+                                     [this](const juce::var& event) {
+                                       // Only the focused page is updated at
+                                       // the display refresh rate
+                                       pageHasFocus =
+                                           static_cast<bool>(event["focused"]);
+                                     })) {
+  static_assert(std::size(scalarFieldNames) == NUM_SCALAR_FIELDS);
+
   expansionAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
       *audioProcessor.apvts.getParameter("expansion"), expansionRelay, nullptr);
 
@@ -98,6 +118,9 @@ SoundFieldAudioProcessorEditor::SoundFieldAudioProcessorEditor(
 
 SoundFieldAudioProcessorEditor::~SoundFieldAudioProcessorEditor() {
   stopTimer();
+  DBG("audioAnalysis events emitted: " << getNumEmittedEvents()
+                                       << ", suppressed: "
+                                       << getNumSuppressedEvents());
 }
 
 void SoundFieldAudioProcessorEditor::paint(juce::Graphics &g) {
@@ -123,38 +146,140 @@ void SoundFieldAudioProcessorEditor::timerCallback() {
       browser.goToURL(resourceRoot);
     }
 
-    // Start the data update timer at 15Hz
-    startTimerHz(15);
+    // Start the data update timer at the background rate; it adapts from
+    // there depending on audio activity and focus
+    currentTimerHz = BACKGROUND_TIMER_HZ;
+    lastActiveTimeMs = juce::Time::getMillisecondCounter();
+    startTimerHz(currentTimerHz);
     return;
   }
 
+  updateTimerRate(emitAnalysisFrame(captureFrame()));
+}
+
+SoundFieldAudioProcessorEditor::AnalysisFrame
+SoundFieldAudioProcessorEditor::captureFrame() const {
+  // Values below the noise floor are snapped to zero so that residual noise
+  // on a silent input reads as an unchanged frame
+  auto gate = [](float value) {
+    return std::abs(value) < NOISE_FLOOR ? 0.0f : value;
+  };
+
+  AnalysisFrame frame;
+  frame.scalars = {gate(audioProcessor.dryRms.load()),
+                   gate(audioProcessor.wetRms.load()),
+                   gate(audioProcessor.dryWidth.load()),
+                   gate(audioProcessor.wetWidth.load()),
+                   gate(audioProcessor.inputLevelL.load()),
+                   gate(audioProcessor.inputLevelR.load()),
+                   gate(audioProcessor.outputLevelL.load()),
+                   gate(audioProcessor.outputLevelR.load()),
+                   gate(audioProcessor.spectralLow.load()),
+                   gate(audioProcessor.spectralMid.load()),
+                   gate(audioProcessor.spectralHigh.load())};
+
+  for (int i = 0; i < SoundFieldAudioProcessor::NUM_BANDS; ++i)
+    frame.bands[static_cast<size_t>(i)] =
+        gate(audioProcessor.spectralBands[i].load());
+
+  frame.bypass =
+      audioProcessor.apvts.getRawParameterValue("bypass")->load() > 0.5f;
+
+  return frame;
+}
+
+// Returns true if an event carrying at least one changed field was sent
+bool SoundFieldAudioProcessorEditor::emitAnalysisFrame(
+    const AnalysisFrame &frame) {
+  // Nothing reaches a hidden browser, so resend everything once it shows.
+  // These ticks are not counted as suppressed events.
+  if (!browser.isShowing()) {
+    needsFullFrame = true;
+    return false;
+  }
+
+  // Crossing into or out of silence always counts, so the UI settles at zero
+  auto hasChanged = [this](float current, float previous) {
+    const float threshold = juce::jmax(
+        CHANGE_ABSOLUTE,
+        CHANGE_RELATIVE * juce::jmax(std::abs(current), std::abs(previous)));
+    return needsFullFrame || (current == 0.0f) != (previous == 0.0f) ||
+           std::abs(current - previous) >= threshold;
+  };
+
   juce::DynamicObject::Ptr data = new juce::DynamicObject();
 
-  // Dry/Wet visualization data
-  data->setProperty("dryRms", audioProcessor.dryRms.load());
-  data->setProperty("wetRms", audioProcessor.wetRms.load());
-  data->setProperty("dryWidth", audioProcessor.dryWidth.load());
-  data->setProperty("wetWidth", audioProcessor.wetWidth.load());
-
-  // Level meters
-  data->setProperty("inputL", audioProcessor.inputLevelL.load());
-  data->setProperty("inputR", audioProcessor.inputLevelR.load());
-  data->setProperty("outputL", audioProcessor.outputLevelL.load());
-  data->setProperty("outputR", audioProcessor.outputLevelR.load());
-
-  data->setProperty("spectralLow", audioProcessor.spectralLow.load());
-  data->setProperty("spectralMid", audioProcessor.spectralMid.load());
-  data->setProperty("spectralHigh", audioProcessor.spectralHigh.load());
-
-  juce::Array<juce::var> bandsArray;
-  for (int i = 0; i < SoundFieldAudioProcessor::NUM_BANDS; ++i) {
-    bandsArray.add(audioProcessor.spectralBands[i].load());
+  // Dry/Wet visualization data, level meters and legacy 3-band spectrum
+  for (size_t i = 0; i < frame.scalars.size(); ++i) {
+    if (hasChanged(frame.scalars[i], lastSentFrame.scalars[i])) {
+      data->setProperty(scalarFieldNames[i], frame.scalars[i]);
+      lastSentFrame.scalars[i] = frame.scalars[i];
+    }
   }
-  data->setProperty("spectralBands", bandsArray);
 
-  data->setProperty(
-      "cppBypass",
-      audioProcessor.apvts.getRawParameterValue("bypass")->load() > 0.5f);
+  // Bands are consumed as a whole array, so send all of them if any moved
+  bool bandsChanged = false;
+  for (size_t i = 0; i < frame.bands.size(); ++i)
+    bandsChanged |= hasChanged(frame.bands[i], lastSentFrame.bands[i]);
+
+  if (bandsChanged) {
+    juce::Array<juce::var> bandsArray;
+    for (float band : frame.bands)
+      bandsArray.add(band);
+    data->setProperty("spectralBands", bandsArray);
+    lastSentFrame.bands = frame.bands;
+  }
+
+  if (needsFullFrame || frame.bypass != lastSentFrame.bypass) {
+    data->setProperty("cppBypass", frame.bypass);
+    lastSentFrame.bypass = frame.bypass;
+  }
+
+  needsFullFrame = false;
+
+  if (data->getProperties().isEmpty()) {
+    ++numSuppressedEvents;
+    return false;
+  }
 
   browser.emitEventIfBrowserIsVisible("audioAnalysis", juce::var(data.get()));
+  ++numEmittedEvents;
+  return true;
+}
+
+void SoundFieldAudioProcessorEditor::updateTimerRate(bool frameWasSent) {
+  // Activity means the UI actually received new values. Frames that stay
+  // unchanged (stopped transport, bypass holding stale values) or sit below
+  // the noise floor are suppressed and let the editor go idle.
+  const auto nowMs = juce::Time::getMillisecondCounter();
+  if (frameWasSent)
+    lastActiveTimeMs = nowMs;
+
+  int targetHz = BACKGROUND_TIMER_HZ;
+  if (!browser.isShowing() || nowMs - lastActiveTimeMs > IDLE_HOLD_MS)
+    targetHz = IDLE_TIMER_HZ;
+  else if (pageHasFocus && juce::Process::isForegroundProcess())
+    targetHz = getDisplayRefreshRateHz();
+
+  // Ramp up gradually (doubling per tick), but drop to a lower rate at once
+  int newHz = targetHz;
+  if (targetHz > currentTimerHz)
+    newHz = juce::jmin(targetHz, currentTimerHz * 2);
+
+  if (newHz != currentTimerHz) {
+    currentTimerHz = newHz;
+    startTimerHz(currentTimerHz);
+  }
+}
+
+int SoundFieldAudioProcessorEditor::getDisplayRefreshRateHz() const {
+  const auto *display =
+      juce::Desktop::getInstance().getDisplays().getDisplayForRect(
+          getScreenBounds());
+
+  if (display != nullptr && display->verticalFrequencyHz.has_value())
+    return juce::jlimit(BACKGROUND_TIMER_HZ, MAX_TIMER_HZ,
+                        juce::roundToInt(*display->verticalFrequencyHz));
+
+  return FALLBACK_REFRESH_HZ;
 }
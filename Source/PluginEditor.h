@@ -2,6 +2,7 @@
 
 #include "PluginProcessor.h"
 #include <JuceHeader.h>
+#include <array>
 
 class SoundFieldAudioProcessorEditor : public juce::AudioProcessorEditor,
                                        private juce::Timer {
@@ -12,9 +13,28 @@ public:
   void paint(juce::Graphics &) override;
   void resized() override;
 
+  // UI update scheduler statistics (message thread)
+  juce::int64 getNumEmittedEvents() const noexcept { return numEmittedEvents; }
+  juce::int64 getNumSuppressedEvents() const noexcept {
+    return numSuppressedEvents;
+  }
+
 private:
   void timerCallback() override;
 
+  // Snapshot of the processor's visualization data, used to diff frames
+  static constexpr int NUM_SCALAR_FIELDS = 11;
+  struct AnalysisFrame {
+    std::array<float, NUM_SCALAR_FIELDS> scalars{};
+    std::array<float, SoundFieldAudioProcessor::NUM_BANDS> bands{};
+    bool bypass = false;
+  };
+
+  AnalysisFrame captureFrame() const;
+  bool emitAnalysisFrame(const AnalysisFrame &frame);
+  void updateTimerRate(bool frameWasSent);
+  int getDisplayRefreshRateHz() const;
+
   SoundFieldAudioProcessor &audioProcessor;
 
   juce::WebSliderRelay expansionRelay;
@@ -36,6 +56,30 @@ private:
   juce::WebBrowserComponent browser;
   bool hasNavigated = false;
 
+  // Adaptive update scheduling: only changed fields are sent, unchanged or
+  // silent frames are suppressed, and the timer rate follows audio activity
+  AnalysisFrame lastSentFrame;
+  bool needsFullFrame = true;
+  bool pageHasFocus = false;
+  int currentTimerHz = 0;
+  juce::uint32 lastActiveTimeMs = 0;
+  juce::int64 numEmittedEvents = 0;
+  juce::int64 numSuppressedEvents = 0;
+
+  static constexpr int IDLE_TIMER_HZ = 4;
+  static constexpr int BACKGROUND_TIMER_HZ = 15;
+  static constexpr int FALLBACK_REFRESH_HZ = 60;
+  static constexpr int MAX_TIMER_HZ = 240;
+  static constexpr juce::uint32 IDLE_HOLD_MS = 1500;
+
+  // The UI meters show -60..0 dB and the input meters add up to +12 dB of
+  // input gain, so anything below -72 dBFS is never visible
+  static constexpr float NOISE_FLOOR = 2.5e-4f;
+  // Min change to resend: relative (~0.4 dB) to match the log-scaled meters,
+  // with an absolute floor for values near zero
+  static constexpr float CHANGE_RELATIVE = 0.05f;
+  static constexpr float CHANGE_ABSOLUTE = 1.0e-4f;
+
   // Set to true to use Vite dev server, false to use embedded assets
   // For production, build WebUI (npm run build), embed dist/ as BinaryData,
   // and implement ResourceProvider in the constructor
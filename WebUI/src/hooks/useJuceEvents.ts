@@ -68,12 +68,31 @@ export function useJuceAudioAnalysis(): AudioAnalysisData {
         const backend = window.__JUCE__?.backend;
         if (!backend?.addEventListener) return;
 
+        // The editor only sends fields that changed since its last event,
+        // so merge each update into the previous state
         const unsubscribe = backend.addEventListener(
             'audioAnalysis',
-            (eventData) => setData(eventData as AudioAnalysisData)
+            (eventData) => setData(prev => ({ ...prev, ...(eventData as Partial<AudioAnalysisData>) }))
         );
 
-        return () => unsubscribe?.();
+        // Ask for a full frame so fields that are currently static get populated
+        backend.emitEvent('audioAnalysisResync', {});
+
+        // The editor only runs at the display refresh rate while this page has focus
+        const emitFocus = (focused: boolean) =>
+            backend.emitEvent('audioAnalysisFocus', { focused });
+        const onFocus = () => emitFocus(true);
+        const onBlur = () => emitFocus(false);
+
+        window.addEventListener('focus', onFocus);
+        window.addEventListener('blur', onBlur);
+        emitFocus(document.hasFocus());
+
+        return () => {
+            unsubscribe?.();
+            window.removeEventListener('focus', onFocus);
+            window.removeEventListener('blur', onBlur);
+        };
     }, []);
 
     return data;